@@ -269,6 +269,25 @@ HA_EXPORT ha_fontfile_t* HA_CALL ha_fontfile_from_memory(uint8_t *data, uint32_t
 */
 HA_EXPORT ha_fontfile_t* HA_CALL ha_fontfile_from_memory_with_name(uint8_t *data, uint32_t length, const char *name);
 
+/**
+    Creates a new font for the given memory slice, without
+    copying it.
+
+    Params:
+        data =  The memory slice to read the font data from.
+        length = The length of the memory slice to read the data from.
+    
+    Returns:
+        A $(D ha_fontfile_t*) instance on success,
+        $(D null) on failure.
+    
+    Note:
+        The memory is read in place, it must be kept alive and
+        unchanged for as long as the font file, or any font or face
+        created from it, is in use.
+*/
+HA_EXPORT ha_fontfile_t* HA_CALL ha_fontfile_from_memory_borrowed(uint8_t *data, uint32_t length);
+
 /**
     Creates a new font for the given file path
 
@@ -464,6 +483,22 @@ HA_EXPORT ha_glyph_metrics_t HA_CALL ha_font_glyph_metrics_for(ha_font_t *obj, u
 */
 HA_EXPORT uint32_t HA_CALL ha_font_find_glyph(ha_font_t *obj, uint32_t codepoint);
 
+/**
+    Gets the base IDs of the glyphs within the font associated
+    with the given code points.
+    
+    Params:
+        obj = The object to query.
+        codepoints = The Unicode code points of the glyphs.
+        glyphIds = Where to store the glyph IDs, may be the same
+            memory as codepoints.
+        count = The amount of code points to map.
+    
+    Note:
+        Code points without a glyph are mapped to $(D GLYPH_MISSING).
+*/
+HA_EXPORT void HA_CALL ha_font_find_glyphs(ha_font_t *obj, const uint32_t *codepoints, uint32_t *glyphIds, uint32_t count);
+
 /**
     Creates a new face object from the font.
     
@@ -725,6 +760,8 @@ HA_EXPORT bool HA_CALL ha_glyph_get_has_data(ha_glyph_t *obj);
         NOT free the SVG data. The data is encoded in UTF-8.
         If no SVG is associated with the glyph, $(D null) is 
         returned and $(D length) is set to $(D 0). 
+        Compressed documents are returned inflated, the data
+        is not copied and is not null terminated.
 */
 HA_EXPORT const char** HA_CALL ha_glyph_get_svg(ha_glyph_t *obj, uint32_t *length);
 
@@ -829,6 +866,20 @@ HA_EXPORT ha_family_t** HA_CALL ha_collection_get_families(ha_collection_t *obj)
 */
 HA_EXPORT void HA_CALL ha_collection_add_family(ha_collection_t *obj, ha_family_t *family);
 
+/**
+    Gets the first face descriptor in the collection that supports
+    a given character.
+
+    Params:
+        obj = The object to query
+        character = The unicode character to query
+    
+    Returns:
+        A $(D ha_info_t*) descriptor on success,
+        $(D null) otherwise.
+*/
+HA_EXPORT ha_info_t* HA_CALL ha_collection_get_first_with(ha_collection_t *obj, uint32_t character);
+
 
 /**
     Gets the name of a font family.